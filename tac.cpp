@@ -15,6 +15,9 @@ const int BOARD_SIZE = 3;
 const int CELL_SIZE = 150;
 const int BOARD_OFFSET_X = (WINDOW_WIDTH - BOARD_SIZE * CELL_SIZE) / 2;
 const int BOARD_OFFSET_Y = (WINDOW_HEIGHT - BOARD_SIZE * CELL_SIZE) / 2;
+const int MAX_PLIES = BOARD_SIZE * BOARD_SIZE; // A game can never outlast the board
+const int TIMELINE_Y = BOARD_OFFSET_Y + BOARD_SIZE * CELL_SIZE + 30;
+const int TIMELINE_HEIGHT = 16;
 
 // Define PI if not already defined
 #ifndef M_PI
@@ -25,8 +28,18 @@ const int BOARD_OFFSET_Y = (WINDOW_HEIGHT - BOARD_SIZE * CELL_SIZE) / 2;
 enum GameState { MENU, SINGLE_PLAYER, TWO_PLAYER, GAME_OVER };
 enum Player { NONE, X, O };
 
+// A single ply stored as a delta against the previous board
+struct Move {
+    unsigned char row, col;
+    Player player;
+};
+
 struct Game {
     Player board[BOARD_SIZE][BOARD_SIZE];
+    Move history[MAX_PLIES]; // Moves played so far, including undone ones
+    int historyLength;       // Number of valid entries in history
+    int ply;                 // Number of moves currently applied to the board
+    bool aiPending;          // An AI move is scheduled on the GLUT timer
     Player currentPlayer;
     GameState state;
     Player winner;
@@ -65,11 +78,49 @@ void initGame() {
             game.board[i][j] = NONE;
         }
     }
+    game.historyLength = 0;
+    game.ply = 0;
     game.currentPlayer = X;
     game.winner = NONE;
     game.gameOver = false;
 }
 
+// Place a mark and append it to the history, discarding any redo branch
+void recordMove(int row, int col, Player player) {
+    game.board[row][col] = player;
+    game.history[game.ply].row = (unsigned char)row;
+    game.history[game.ply].col = (unsigned char)col;
+    game.history[game.ply].player = player;
+    game.ply++;
+    game.historyLength = game.ply;
+}
+
+// Take back the last applied move in O(1)
+bool undoMove() {
+    if (game.ply == 0) return false;
+    const Move& m = game.history[--game.ply];
+    game.board[m.row][m.col] = NONE;
+    game.currentPlayer = m.player;
+    return true;
+}
+
+// Re-apply the next recorded move in O(1)
+bool redoMove() {
+    if (game.ply == game.historyLength) return false;
+    const Move& m = game.history[game.ply++];
+    game.board[m.row][m.col] = m.player;
+    game.currentPlayer = (m.player == X) ? O : X;
+    return true;
+}
+
+// Jump to any ply of the recorded game, one constant-time delta per step
+void seekPly(int target) {
+    if (target < 0) target = 0;
+    if (target > game.historyLength) target = game.historyLength;
+    while (game.ply > target) undoMove();
+    while (game.ply < target) redoMove();
+}
+
 // Check if there's a winner or draw
 void checkGameState() {
     // Check rows
@@ -144,7 +195,7 @@ void checkGameState() {
 
 // Simple AI move (random)
 void makeAIMove() {
-    if (game.gameOver) return;
+    if (game.gameOver || game.state != SINGLE_PLAYER || game.currentPlayer != O) return;
 
     vector<pair<int, int>> emptyCells;
     for (int i = 0; i < BOARD_SIZE; ++i) {
@@ -159,12 +210,60 @@ void makeAIMove() {
         int randomIndex = rand() % emptyCells.size();
         int row = emptyCells[randomIndex].first;
         int col = emptyCells[randomIndex].second;
-        game.board[row][col] = O;
+        recordMove(row, col, O);
         game.currentPlayer = X;
         checkGameState();
     }
 }
 
+// Queue the AI reply so the player's move is drawn first
+void scheduleAIMove() {
+    if (game.aiPending) return;
+    game.aiPending = true;
+    glutTimerFunc(500, [](int) { game.aiPending = false; makeAIMove(); glutPostRedisplay(); }, 0);
+}
+
+// Whether the board may be rewound or replayed right now
+bool canNavigateHistory() {
+    return (game.state == SINGLE_PLAYER || game.state == TWO_PLAYER) && !game.gameOver;
+}
+
+// Re-evaluate the position after moving through the history
+void afterHistoryNavigation() {
+    checkGameState();
+    if (!game.gameOver && game.state == SINGLE_PLAYER && game.currentPlayer == O) {
+        scheduleAIMove();
+    }
+}
+
+// Step back one turn (in single player, back to the human's move)
+void undoTurn() {
+    if (!canNavigateHistory() || !undoMove()) return;
+    if (game.state == SINGLE_PLAYER && game.currentPlayer == O) {
+        undoMove();
+    }
+    afterHistoryNavigation();
+}
+
+// Step forward one turn (in single player, replaying the AI reply too)
+void redoTurn() {
+    if (!canNavigateHistory() || !redoMove()) return;
+    if (game.state == SINGLE_PLAYER && game.currentPlayer == O) {
+        redoMove();
+    }
+    afterHistoryNavigation();
+}
+
+// Jump straight to a ply (in single player, only to the human's turns)
+void scrubTo(int target) {
+    if (!canNavigateHistory()) return;
+    if (game.state == SINGLE_PLAYER && target < game.historyLength) {
+        target -= target % 2;
+    }
+    seekPly(target);
+    afterHistoryNavigation();
+}
+
 // Draw text with shadow effect
 void drawText(float x, float y, const string& text, const Color& color, void* font = GLUT_BITMAP_HELVETICA_18) {
     // Shadow
@@ -309,6 +408,43 @@ void drawScoreboard() {
     drawText(WINDOW_WIDTH/2 + 50, 50, drawScoreText, drawScoreColor, GLUT_BITMAP_HELVETICA_18);
 }
 
+// Draw the move timeline below the board
+void drawTimeline() {
+    float x = BOARD_OFFSET_X;
+    float width = BOARD_SIZE * CELL_SIZE;
+
+    drawRoundedRect(x - 10, TIMELINE_Y - 6, width + 20, TIMELINE_HEIGHT + 12, COLOR_SCORE_BG, 8.0f);
+
+    // Filled portion up to the current ply
+    if (game.historyLength > 0) {
+        float filled = width * game.ply / MAX_PLIES;
+        glColor3f(COLOR_HIGHLIGHT.r, COLOR_HIGHLIGHT.g, COLOR_HIGHLIGHT.b);
+        glBegin(GL_QUADS);
+        glVertex2f(x, TIMELINE_Y + 4);
+        glVertex2f(x + filled, TIMELINE_Y + 4);
+        glVertex2f(x + filled, TIMELINE_Y + TIMELINE_HEIGHT - 4);
+        glVertex2f(x, TIMELINE_Y + TIMELINE_HEIGHT - 4);
+        glEnd();
+    }
+
+    // One tick per recorded move, colored by player
+    glLineWidth(3.0f);
+    glBegin(GL_LINES);
+    for (int i = 0; i < game.historyLength; ++i) {
+        const Color& c = (game.history[i].player == X) ? COLOR_X : COLOR_O;
+        float dim = (i < game.ply) ? 1.0f : 0.4f;
+        float tickX = x + width * (i + 1) / MAX_PLIES;
+        glColor3f(c.r * dim, c.g * dim, c.b * dim);
+        glVertex2f(tickX, TIMELINE_Y);
+        glVertex2f(tickX, TIMELINE_Y + TIMELINE_HEIGHT);
+    }
+    glEnd();
+
+    string plyText = "Move " + to_string(game.ply) + "/" + to_string(game.historyLength);
+    drawText(x + width + 20, TIMELINE_Y + 13, plyText, COLOR_TEXT, GLUT_BITMAP_HELVETICA_12);
+    drawText(20, TIMELINE_Y + 13, "U/R: undo/redo", COLOR_DRAW, GLUT_BITMAP_HELVETICA_12);
+}
+
 // Draw the game board
 void drawBoard() {
     // Draw scoreboard
@@ -371,6 +507,8 @@ void drawBoard() {
     playerColor.b *= pulse;
     
     drawText(50, 50, playerText, playerColor, GLUT_BITMAP_HELVETICA_18);
+
+    drawTimeline();
 }
 
 // Draw animated menu title
@@ -567,6 +705,13 @@ void mouse(int button, int state, int x, int y) {
             }
         } 
         else if (game.state == SINGLE_PLAYER || game.state == TWO_PLAYER) {
+            // Check timeline clicks
+            if (x >= BOARD_OFFSET_X - 10 && x <= BOARD_OFFSET_X + BOARD_SIZE * CELL_SIZE + 10 &&
+                y >= TIMELINE_Y - 6 && y <= TIMELINE_Y + TIMELINE_HEIGHT + 6) {
+                float t = (float)(x - BOARD_OFFSET_X) / (BOARD_SIZE * CELL_SIZE);
+                scrubTo((int)lround(t * MAX_PLIES));
+            }
+
             // Check board clicks
             if (x >= BOARD_OFFSET_X && x <= BOARD_OFFSET_X + BOARD_SIZE * CELL_SIZE &&
                 y >= BOARD_OFFSET_Y && y <= BOARD_OFFSET_Y + BOARD_SIZE * CELL_SIZE) {
@@ -576,7 +721,7 @@ void mouse(int button, int state, int x, int y) {
                     int col = (y - BOARD_OFFSET_Y) / CELL_SIZE;
                     
                     if (game.board[row][col] == NONE) {
-                        game.board[row][col] = game.currentPlayer;
+                        recordMove(row, col, game.currentPlayer);
                         checkGameState();
                         
                         if (!game.gameOver) {
@@ -585,7 +730,7 @@ void mouse(int button, int state, int x, int y) {
                             // If single player and AI's turn
                             if (game.state == SINGLE_PLAYER && game.currentPlayer == O) {
                                 glutPostRedisplay(); // Update display before AI move
-                                glutTimerFunc(500, [](int) { makeAIMove(); glutPostRedisplay(); }, 0);
+                                scheduleAIMove();
                             }
                         }
                     }
@@ -603,6 +748,26 @@ void mouse(int button, int state, int x, int y) {
     glutPostRedisplay();
 }
 
+// Handle keyboard shortcuts for move history
+void keyboard(unsigned char key, int x, int y) {
+    switch (key) {
+        case 'u': case 'U': undoTurn(); break;
+        case 'r': case 'R': redoTurn(); break;
+    }
+    glutPostRedisplay();
+}
+
+// Handle arrow/Home/End keys for scrubbing through the timeline
+void specialKeys(int key, int x, int y) {
+    switch (key) {
+        case GLUT_KEY_LEFT:  undoTurn(); break;
+        case GLUT_KEY_RIGHT: redoTurn(); break;
+        case GLUT_KEY_HOME:  scrubTo(0); break;
+        case GLUT_KEY_END:   scrubTo(game.historyLength); break;
+    }
+    glutPostRedisplay();
+}
+
 // Handle mouse motion for hover effects
 void mouseMotion(int x, int y) {
     glutPostRedisplay();
@@ -641,6 +806,8 @@ int main(int argc, char** argv) {
     game.scoreX = 0;
     game.scoreO = 0;
     game.scoreDraw = 0;
+    game.aiPending = false;
+    initGame();
     
     // Initialize GLUT
     glutInit(&argc, argv);
@@ -651,6 +818,8 @@ int main(int argc, char** argv) {
     // Register callbacks
     glutDisplayFunc(display);
     glutMouseFunc(mouse);
+    glutKeyboardFunc(keyboard);
+    glutSpecialFunc(specialKeys);
     glutPassiveMotionFunc(mouseMotion);
     glutTimerFunc(0, timer, 0);
     